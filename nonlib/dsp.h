@@ -38,6 +38,7 @@ void buffer_interleaved_copy ( sample_t *__restrict__ dst, const sample_t * __re
 void buffer_fill_with_silence ( sample_t *buf, nframes_t nframes );
 bool buffer_is_digital_black ( const sample_t *buf, nframes_t nframes );
 float buffer_get_peak ( const sample_t *buf, nframes_t nframes );
+void buffer_fold_min_max ( sample_t *dst, const sample_t *src, int pairs, nframes_t rows );
 void buffer_copy ( sample_t *dst, const sample_t *src, nframes_t nframes );
 void buffer_copy_and_apply_gain ( sample_t *dst, const sample_t *src, nframes_t nframes, float gain );
 
@@ -0,0 +1,78 @@
+/*******************************************************************************/
+/* Copyright (C) 2013 Jonathan Moore Liles                                     */
+/*                                                                             */
+/* This program is free software; you can redistribute it and/or modify it     */
+/* under the terms of the GNU General Public License as published by the       */
+/* Free Software Foundation; either version 2 of the License, or (at your      */
+/* option) any later version.                                                  */
+/*                                                                             */
+/* This program is distributed in the hope that it will be useful, but WITHOUT */
+/* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or       */
+/* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for   */
+/* more details.                                                               */
+/*                                                                             */
+/* You should have received a copy of the GNU General Public License along     */
+/* with This program; see the file COPYING.  If not,write to the Free Software */
+/* Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.  */
+/*******************************************************************************/
+
+#pragma once
+
+/* Tables of the instruction set specific implementations behind the
+ * buffer_* functions in dsp.h. One table is chosen at startup (see
+ * dsp_kernels_select()); the scalar table is the reference that the
+ * others must agree with. */
+
+#include "dsp.h"
+
+struct dsp_kernels
+{
+    const char *name;
+
+    bool (*supported) ( void );
+
+    void (*apply_gain) ( sample_t *buf, nframes_t nframes, float g );
+    void (*apply_gain_buffer) ( sample_t *buf, const sample_t *gainbuf, nframes_t nframes );
+    void (*copy_and_apply_gain_buffer) ( sample_t *dst, const sample_t *src, const sample_t *gainbuf, nframes_t nframes );
+    void (*mix) ( sample_t *dst, const sample_t *src, nframes_t nframes );
+    void (*mix_with_gain) ( sample_t *dst, const sample_t *src, nframes_t nframes, float g );
+    void (*copy_and_apply_gain) ( sample_t *dst, const sample_t *src, nframes_t nframes, float g );
+    void (*interleave_one_channel) ( sample_t *dst, const sample_t *src, int channel, int channels, nframes_t nframes );
+    void (*interleave_one_channel_and_mix) ( sample_t *dst, const sample_t *src, int channel, int channels, nframes_t nframes );
+    void (*deinterleave_one_channel) ( sample_t *dst, const sample_t *src, int channel, int channels, nframes_t nframes );
+    void (*interleaved_mix) ( sample_t *dst, const sample_t *src, int dst_channel, int src_channel, int dst_channels, int src_channels, nframes_t nframes );
+    void (*interleaved_copy) ( sample_t *dst, const sample_t *src, int dst_channel, int src_channel, int dst_channels, int src_channels, nframes_t nframes );
+    bool (*is_digital_black) ( const sample_t *buf, nframes_t nframes );
+    float (*get_peak) ( const sample_t *buf, nframes_t nframes );
+    void (*fold_min_max) ( sample_t *dst, const sample_t *src, int pairs, nframes_t rows );
+};
+
+/* fold /v/ into column /c/ of a row of interleaved (min, max) pairs */
+static inline void
+fold_min_max_one ( sample_t *dst, int c, sample_t v )
+{
+    if ( c & 1 )
+        dst[c] = v > dst[c] ? v : dst[c];
+    else
+        dst[c] = v < dst[c] ? v : dst[c];
+}
+
+extern const dsp_kernels dsp_kernels_scalar;
+
+#if defined(__x86_64__) || defined(__i386__)
+extern const dsp_kernels dsp_kernels_sse2;
+#ifdef HAVE_AVX2_INTRINSICS
+extern const dsp_kernels dsp_kernels_avx2;
+#endif
+#ifdef HAVE_AVX512_INTRINSICS
+extern const dsp_kernels dsp_kernels_avx512;
+#endif
+#endif
+
+/* all kernel tables compiled in, best last, NULL terminated */
+extern const dsp_kernels * const dsp_kernels_all[];
+
+const dsp_kernels *dsp_kernels_current ( void );
+bool dsp_kernels_select ( const dsp_kernels *k );
+const dsp_kernels *dsp_kernels_find ( const char *name );
+int dsp_kernels_verify ( const dsp_kernels *k );
@@ -0,0 +1,207 @@
+/*******************************************************************************/
+/* Copyright (C) 2013 Jonathan Moore Liles                                     */
+/*                                                                             */
+/* This program is free software; you can redistribute it and/or modify it     */
+/* under the terms of the GNU General Public License as published by the       */
+/* Free Software Foundation; either version 2 of the License, or (at your      */
+/* option) any later version.                                                  */
+/*                                                                             */
+/* This program is distributed in the hope that it will be useful, but WITHOUT */
+/* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or       */
+/* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for   */
+/* more details.                                                               */
+/*                                                                             */
+/* You should have received a copy of the GNU General Public License along     */
+/* with This program; see the file COPYING.  If not,write to the Free Software */
+/* Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.  */
+/*******************************************************************************/
+
+/* Vector implementations of the contiguous buffer kernels, written
+ * once in terms of the V* macros and included by dsp_x86.C once for
+ * each instruction set. There is intentionally no include guard. The
+ * including file must define:
+ *
+ *     K(name)      mangle /name/ for this instruction set
+ *     TARGET       function attribute enabling the instruction set
+ *     WIDTH        number of floats in a vector
+ *     vec_t        the vector type
+ *     VLOAD, VSTORE, VSET1, VZERO, VADD, VMUL, VMAX, VABS
+ *     VHMAX(v)     horizontal maximum of /v/
+ *     VMINMAX(a,b) minimum of /a/ and /b/ in even lanes, maximum in odd ones
+ *     VANY(v)      true if any element of /v/ is nonzero
+ *
+ * All loads and stores are unaligned, so any buffer may be passed
+ * in. Leftover frames are done one at a time, in the same order of
+ * operations as the scalar reference, so results are bit-identical
+ * to it. */
+
+static void TARGET
+K(apply_gain) ( sample_t * __restrict__ buf, nframes_t nframes, float g )
+{
+    const vec_t G = VSET1( g );
+
+    nframes_t i = 0;
+
+    for ( ; i + WIDTH <= nframes; i += WIDTH )
+        VSTORE( buf + i, VMUL( VLOAD( buf + i ), G ) );
+
+    for ( ; i < nframes; i++ )
+        buf[i] *= g;
+}
+
+static void TARGET
+K(apply_gain_buffer) ( sample_t * __restrict__ buf, const sample_t * __restrict__ gainbuf, nframes_t nframes )
+{
+    nframes_t i = 0;
+
+    for ( ; i + WIDTH <= nframes; i += WIDTH )
+        VSTORE( buf + i, VMUL( VLOAD( buf + i ), VLOAD( gainbuf + i ) ) );
+
+    for ( ; i < nframes; i++ )
+        buf[i] *= gainbuf[i];
+}
+
+static void TARGET
+K(copy_and_apply_gain_buffer) ( sample_t * __restrict__ dst, const sample_t * __restrict__ src, const sample_t * __restrict__ gainbuf, nframes_t nframes )
+{
+    nframes_t i = 0;
+
+    for ( ; i + WIDTH <= nframes; i += WIDTH )
+        VSTORE( dst + i, VMUL( VLOAD( src + i ), VLOAD( gainbuf + i ) ) );
+
+    for ( ; i < nframes; i++ )
+        dst[i] = src[i] * gainbuf[i];
+}
+
+static void TARGET
+K(mix) ( sample_t * __restrict__ dst, const sample_t * __restrict__ src, nframes_t nframes )
+{
+    nframes_t i = 0;
+
+    for ( ; i + WIDTH <= nframes; i += WIDTH )
+        VSTORE( dst + i, VADD( VLOAD( dst + i ), VLOAD( src + i ) ) );
+
+    for ( ; i < nframes; i++ )
+        dst[i] += src[i];
+}
+
+static void TARGET
+K(mix_with_gain) ( sample_t * __restrict__ dst, const sample_t * __restrict__ src, nframes_t nframes, float g )
+{
+    const vec_t G = VSET1( g );
+
+    nframes_t i = 0;
+
+    for ( ; i + WIDTH <= nframes; i += WIDTH )
+        VSTORE( dst + i, VADD( VLOAD( dst + i ), VMUL( VLOAD( src + i ), G ) ) );
+
+    for ( ; i < nframes; i++ )
+        dst[i] += src[i] * g;
+}
+
+static void TARGET
+K(copy_and_apply_gain) ( sample_t * __restrict__ dst, const sample_t * __restrict__ src, nframes_t nframes, float g )
+{
+    const vec_t G = VSET1( g );
+
+    nframes_t i = 0;
+
+    for ( ; i + WIDTH <= nframes; i += WIDTH )
+        VSTORE( dst + i, VMUL( VLOAD( src + i ), G ) );
+
+    for ( ; i < nframes; i++ )
+        dst[i] = src[i] * g;
+}
+
+static bool TARGET
+K(is_digital_black) ( const sample_t *buf, nframes_t nframes )
+{
+    nframes_t i = 0;
+
+    /* check a few vectors at a time, most buffers that aren't black
+     * fail right at the start */
+    for ( ; i + WIDTH * 4 <= nframes; i += WIDTH * 4 )
+    {
+        if ( VANY( VLOAD( buf + i ) ) ||
+             VANY( VLOAD( buf + i + WIDTH ) ) ||
+             VANY( VLOAD( buf + i + WIDTH * 2 ) ) ||
+             VANY( VLOAD( buf + i + WIDTH * 3 ) ) )
+            return false;
+    }
+
+    for ( ; i < nframes; i++ )
+        if ( buf[i] )
+            return false;
+
+    return true;
+}
+
+static float TARGET
+K(get_peak) ( const sample_t * __restrict__ buf, nframes_t nframes )
+{
+    /* two accumulators to hide the latency of max */
+    vec_t p1 = VZERO();
+    vec_t p2 = VZERO();
+
+    nframes_t i = 0;
+
+    for ( ; i + WIDTH * 2 <= nframes; i += WIDTH * 2 )
+    {
+        p1 = VMAX( p1, VABS( VLOAD( buf + i ) ) );
+        p2 = VMAX( p2, VABS( VLOAD( buf + i + WIDTH ) ) );
+    }
+
+    float p = VHMAX( VMAX( p1, p2 ) );
+
+    for ( ; i < nframes; i++ )
+    {
+        const float a = fabsf( buf[i] );
+
+        p = a > p ? a : p;
+    }
+
+    return p;
+}
+
+static void TARGET
+K(fold_min_max) ( sample_t * __restrict__ dst, const sample_t * __restrict__ src, int pairs, nframes_t rows )
+{
+    const int w = pairs * 2;
+
+    if ( WIDTH % w == 0 && rows * w >= WIDTH )
+    {
+        /* a vector holds a whole number of rows, so each lane always
+         * sees the same column */
+        const nframes_t n = rows * w;
+
+        vec_t acc = VLOAD( src );
+
+        nframes_t i = WIDTH;
+
+        for ( ; i + WIDTH <= n; i += WIDTH )
+            acc = VMINMAX( acc, VLOAD( src + i ) );
+
+        float t[ WIDTH ];
+
+        VSTORE( t, acc );
+
+        for ( int l = 0; l < WIDTH; l++ )
+            fold_min_max_one( dst, l % w, t[l] );
+
+        for ( ; i < n; i++ )
+            fold_min_max_one( dst, i % w, src[i] );
+    }
+    else if ( w % WIDTH == 0 )
+    {
+        /* rows are a whole number of vectors */
+        for ( ; rows--; src += w )
+            for ( int c = 0; c < w; c += WIDTH )
+                VSTORE( dst + c, VMINMAX( VLOAD( dst + c ), VLOAD( src + c ) ) );
+    }
+    else
+    {
+        for ( ; rows--; src += w )
+            for ( int c = 0; c < w; c++ )
+                fold_min_max_one( dst, c, src[c] );
+    }
+}